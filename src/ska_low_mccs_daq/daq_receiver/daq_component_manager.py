@@ -9,6 +9,7 @@
 from __future__ import annotations
 
 import logging
+import queue
 import threading
 import warnings
 from typing import Any, Callable, Optional, Sequence, Union
@@ -24,6 +25,19 @@ __all__ = ["DaqComponentManager"]
 class DaqComponentManager(MccsComponentManager):
     """A component manager for a DaqReceiver."""
 
+    # Configuration keys that determine the receiver's network binding and
+    # ring geometry. Changing any of these requires the receiver itself to
+    # be re-initialised, not just its consumers restarted.
+    _RECEIVER_BINDING_KEYS = (
+        "receiver_interface",
+        "receiver_ip",
+        "receiver_ports",
+        "receiver_frame_size",
+        "receiver_frames_per_block",
+        "receiver_nof_blocks",
+        "receiver_nof_threads",
+    )
+
     # pylint: disable=too-many-arguments
     def __init__(
         self: DaqComponentManager,
@@ -36,6 +50,10 @@ class DaqComponentManager(MccsComponentManager):
         max_workers: int,
         communication_state_changed_callback: Callable[[CommunicationStatus], None],
         component_state_changed_callback: Callable[[dict[str, Any]], None],
+        receiver_backend: str = "",
+        receiver_cpu_set: str = "",
+        receiver_numa_node: int = -1,
+        receiver_hugepages: bool = False,
     ) -> None:
         """
         Initialise a new instance of DaqComponentManager.
@@ -53,6 +71,19 @@ class DaqComponentManager(MccsComponentManager):
             the component manager and its component changes
         :param component_state_changed_callback: callback to be
             called when the component state changes
+        :param receiver_backend: the receive engine the DAQ receiver is
+            to use, e.g. "af_xdp". An empty string selects the library
+            default (raw-socket) receive path.
+        :param receiver_cpu_set: A comma separated list of CPUs the
+            receiver threads are to be pinned to, e.g. "2,4,6". An empty
+            string leaves thread placement to the library.
+        :param receiver_numa_node: The NUMA node the receiver ring
+            blocks are to be allocated on, normally the NIC-local node.
+            -1 leaves memory placement to the library.
+        :param receiver_hugepages: Whether the receiver rings and
+            consumer buffers are to be backed by mlocked 2 MiB huge
+            pages (the library falls back gracefully if none are
+            available).
         """
         self._consumers_to_start: list[DaqModes] | None
 
@@ -63,10 +94,26 @@ class DaqComponentManager(MccsComponentManager):
             component_state_changed_callback,
         )
         self._receiver_started: bool = False
+        self._receiver_init_lock = threading.Lock()
+        self._component_state_changed_callback = component_state_changed_callback
+        # Data-arrival notifications are queued from the consumer
+        # callback thread and forwarded to the device from a worker
+        # thread, so event emission can never stall the persisters.
+        # The forwarder and the stats poller run between
+        # `start_communicating` and `stop_communicating`.
+        self._data_received_queue: queue.Queue = queue.Queue(maxsize=64)
+        self._stats_poll_interval = 1.0
+        self._worker_shutdown = threading.Event()
+        self._event_thread: Optional[threading.Thread] = None
+        self._stats_thread: Optional[threading.Thread] = None
         self._daq_id = daq_id
         self._receiver_interface = receiver_interface
         self._receiver_ip = receiver_ip.encode()
         self._receiver_ports = receiver_ports
+        self._receiver_backend = receiver_backend
+        self._receiver_cpu_set = receiver_cpu_set
+        self._receiver_numa_node = receiver_numa_node
+        self._receiver_hugepages = receiver_hugepages
         self._set_consumers_to_start(consumers_to_start)
         self._create_daq_instance()
 
@@ -74,35 +121,169 @@ class DaqComponentManager(MccsComponentManager):
         self: DaqComponentManager,
     ) -> None:
         """
-        Create and initialise a DAQ instance.
+        Create and configure a DAQ instance, warming it in the background.
 
-        This method creates a DAQ instance and initialises it before
-        returning.
+        The expensive part of initialisation — loading libaavsdaq and
+        allocating the receiver rings — happens on a background thread
+        so that device initialisation is not blocked on it. By the time
+        a client calls `Start` the receiver is normally already warm;
+        `_start_daq` waits for initialisation where it is not.
         """
-        self.logger.info("Creating, configuring and initialising DAQ receiver.")
+        self.logger.info("Creating and configuring DAQ receiver.")
         # Create DAQ instance
         self.daq_instance = DaqReceiver()
 
-        # TODO: `initialise_daq` starts the daq receiver rather than `start_daq`.
-        # `stop_daq` stops the daq receiver.
-        # This means we can't stop the receiver and start it on a new interface unless
-        # we re-init the device which is suboptimal.
-        # It would be better if we could start the receiver in `start_daq` without
-        # having to initialise/reinitialise the entire daq system.
+        # `initialise_daq` binds the receiver and allocates its block pool;
+        # `start_daq` only attaches consumers to it. Stopping data
+        # acquisition therefore leaves the receiver warm where the linked
+        # aavs_system allows it (see `_stop_daq`), and the receiver is only
+        # re-initialised when its network binding changes (see
+        # `configure_daq`).
         try:
             self.configure_daq(self._get_daq_config())
         # pylint: disable=broad-except
         except Exception as e:
             self.logger.error(f"Caught exception in `_create_daq_instance`: {e}")
 
-        # Initialise library and start receiver.
-        self.daq_instance.initialise_daq()
-        self._receiver_started = True
-        self.logger.info("Daq receiver created and initialised.")
+        # Initialise library and start receiver off the init thread.
+        threading.Thread(
+            target=self._initialise_receiver,
+            name=f"daq-{self._daq_id}-init",
+            daemon=True,
+        ).start()
+
+    def _initialise_receiver(self: DaqComponentManager) -> bool:
+        """
+        Initialise the receiver if it is not already initialised.
+
+        Safe to call from any thread; callers racing the background
+        warm-up simply wait for it to complete. A failure (wrong
+        interface, missing capabilities) is logged and reported as a
+        component fault rather than escaping to `threading.excepthook`
+        when warm-up runs in the background.
+
+        :return: whether the receiver is initialised.
+        """
+        with self._receiver_init_lock:
+            if not self._receiver_started:
+                try:
+                    self.daq_instance.initialise_daq()
+                # pylint: disable=broad-except
+                except Exception as e:
+                    self.logger.error(
+                        f"Caught exception initialising DAQ receiver: {e}"
+                    )
+                    self._component_state_changed_callback({"fault": True})
+                    return False
+                self._receiver_started = True
+                self.logger.info("Daq receiver initialised.")
+        return True
+
+    def _notifying_callback(
+        self: DaqComponentManager,
+        callback: Optional[Callable] = None,
+    ) -> Callable:
+        """
+        Wrap a consumer callback so data arrival is also notified.
+
+        Consumer callbacks run on the persister thread, so the
+        notification is a non-blocking enqueue; when the queue is full
+        the notification is dropped (the file itself is unaffected)
+        rather than stalling the persister.
+
+        :param callback: the externally supplied callback to preserve,
+            if any.
+
+        :return: a callback suitable for passing to `start_daq`.
+        """
+
+        def _callback(*args: Any) -> None:
+            try:
+                self._data_received_queue.put_nowait(args)
+            except queue.Full:
+                self.logger.warning(
+                    "Data-received event queue is full. Notification dropped."
+                )
+            if callback is not None:
+                callback(*args)
+
+        return _callback
+
+    def _forward_data_received_events(self: DaqComponentManager) -> None:
+        """Forward queued data-arrival notifications to the device."""
+        while not self._worker_shutdown.is_set():
+            args = self._data_received_queue.get()
+            if args is None:
+                # Shutdown sentinel from `_stop_worker_threads`.
+                continue
+            event = {"data_mode": str(args[0])}
+            if len(args) > 1:
+                event["file_name"] = str(args[1])
+            if len(args) > 2:
+                event["additional_info"] = str(args[2])
+            try:
+                self._component_state_changed_callback({"dataReceived": event})
+            # pylint: disable=broad-except
+            except Exception as e:
+                self.logger.error(
+                    f"Exception caught forwarding data-received event: {e}"
+                )
+
+    def _poll_receiver_stats(self: DaqComponentManager) -> None:
+        """
+        Poll receiver statistics and report them as component state.
+
+        Polling idles while the receiver is not initialised, and reports
+        nothing when the linked aavs_system does not support statistics
+        collection.
+        """
+        while not self._worker_shutdown.wait(self._stats_poll_interval):
+            if not self._receiver_started:
+                continue
+            receiver_stats = self.get_receiver_stats()
+            if not receiver_stats:
+                continue
+            try:
+                self._component_state_changed_callback(
+                    {"receiver_stats": receiver_stats}
+                )
+            # pylint: disable=broad-except
+            except Exception as e:
+                self.logger.error(
+                    f"Exception caught reporting receiver statistics: {e}"
+                )
+
+    def _start_worker_threads(self: DaqComponentManager) -> None:
+        """Start the event forwarder and stats poller threads."""
+        self._worker_shutdown.clear()
+        if self._event_thread is None or not self._event_thread.is_alive():
+            self._event_thread = threading.Thread(
+                target=self._forward_data_received_events,
+                name=f"daq-{self._daq_id}-events",
+                daemon=True,
+            )
+            self._event_thread.start()
+        if self._stats_thread is None or not self._stats_thread.is_alive():
+            self._stats_thread = threading.Thread(
+                target=self._poll_receiver_stats,
+                name=f"daq-{self._daq_id}-stats",
+                daemon=True,
+            )
+            self._stats_thread.start()
+
+    def _stop_worker_threads(self: DaqComponentManager) -> None:
+        """Signal the event forwarder and stats poller threads to exit."""
+        self._worker_shutdown.set()
+        # Wake the forwarder if it is blocked on an empty queue.
+        try:
+            self._data_received_queue.put_nowait(None)
+        except queue.Full:
+            pass
 
     def start_communicating(self: DaqComponentManager) -> None:
         """Establish communication with the DaqReceiver components."""
         super().start_communicating()
+        self._start_worker_threads()
         # Do things that might need to be done.
         # e.g. Do we need to be connected to a station etc?
         # For now we'll just set comms to ESTABLISHED since there's no physical device.
@@ -110,6 +291,7 @@ class DaqComponentManager(MccsComponentManager):
 
     def stop_communicating(self: DaqComponentManager) -> None:
         """Break off communication with the DaqReceiver components."""
+        self._stop_worker_threads()
         super().stop_communicating()
 
     def _get_daq_config(self: DaqComponentManager) -> dict[str, Any]:
@@ -133,7 +315,40 @@ class DaqComponentManager(MccsComponentManager):
             "directory": ".",
             "acquisition_duration": -1,
         }
-        return daq_config
+        if self._receiver_backend != "":
+            daq_config["receiver_backend"] = self._receiver_backend
+        if self._receiver_cpu_set != "":
+            daq_config["receiver_cpu_set"] = self._receiver_cpu_set
+        if self._receiver_numa_node >= 0:
+            daq_config["numa_node"] = self._receiver_numa_node
+        if self._receiver_hugepages:
+            daq_config["receiver_hugepages"] = True
+        return self._filter_unsupported_keys(daq_config)
+
+    def _filter_unsupported_keys(
+        self: DaqComponentManager, daq_config: dict[str, Any]
+    ) -> dict[str, Any]:
+        """
+        Remove configuration keys the linked aavs_system does not know about.
+
+        `DaqReceiver.populate_configuration` rejects any configuration
+        containing unrecognised keys. Optional keys (such as those only
+        present in newer libaavsdaq builds) are therefore dropped, with
+        a warning, rather than failing the whole configuration.
+
+        :param daq_config: A dictionary containing configuration settings.
+
+        :return: the configuration restricted to supported keys.
+        """
+        supported_keys = set(self.daq_instance._config)
+        for key in set(daq_config) - supported_keys:
+            self.logger.warning(
+                f"Dropping `{key}` from DAQ configuration: "
+                "not supported by the linked aavs_system version."
+            )
+        return {
+            key: value for key, value in daq_config.items() if key in supported_keys
+        }
 
     def get_configuration(self: DaqComponentManager) -> dict[str, Any]:
         """
@@ -143,6 +358,58 @@ class DaqComponentManager(MccsComponentManager):
         """
         return self.daq_instance.get_configuration()
 
+    def get_receiver_stats(self: DaqComponentManager) -> dict[str, Any]:
+        """
+        Get receiver statistics from DAQ.
+
+        Statistics (packets received/dropped per port, ring occupancy,
+        per-consumer buffers processed/overflowed) are only available
+        where the linked aavs_system exposes the `getReceiverStats` C
+        API through `DaqReceiver.get_receiver_stats`. For older versions
+        an empty dictionary is returned.
+
+        :return: A dictionary of receiver statistics. Empty if the
+            linked aavs_system does not support statistics collection.
+        """
+        get_stats = getattr(self.daq_instance, "get_receiver_stats", None)
+        if get_stats is None:
+            return {}
+        try:
+            return get_stats()
+        # pylint: disable=broad-except
+        except Exception as e:
+            self.logger.error(f"Exception caught in `get_receiver_stats`: {e}")
+            return {}
+
+    def trigger_antenna_buffer(self: DaqComponentManager) -> tuple[bool, str]:
+        """
+        Trigger a dump of the antenna buffer's in-memory ring to disk.
+
+        Only meaningful when the antenna buffer consumer is running in
+        triggered mode, which requires `trigger_antenna_buffer` support
+        in the linked aavs_system; the dump itself (pre-opened files,
+        async writer) is handled by the consumer.
+
+        :return: whether the trigger was issued, and a message saying
+            why not if it was not.
+        """
+        trigger = getattr(self.daq_instance, "trigger_antenna_buffer", None)
+        if trigger is None:
+            msg = (
+                "Triggered antenna buffer dumps are not supported by the "
+                "linked aavs_system version."
+            )
+            self.logger.error(msg)
+            return (False, msg)
+        try:
+            trigger()
+        # pylint: disable=broad-except
+        except Exception as e:
+            msg = f"Antenna buffer trigger failed: {e}"
+            self.logger.error(msg)
+            return (False, msg)
+        return (True, "TriggerAntennaBuffer command completed OK")
+
     def _get_consumers_to_start(self: DaqComponentManager) -> list[DaqModes]:
         """
         Retrieve a list of DAQ consumers to start.
@@ -201,7 +468,21 @@ class DaqComponentManager(MccsComponentManager):
         """
         self.logger.info("Configuring DAQ receiver.")
         try:
-            self.daq_instance.populate_configuration(daq_config)
+            # Wait out any in-flight background warm-up so we never
+            # reconfigure a receiver that is mid-initialisation.
+            with self._receiver_init_lock:
+                binding_before = self._receiver_binding()
+                self.daq_instance.populate_configuration(daq_config)
+                if (
+                    self._receiver_started
+                    and binding_before != self._receiver_binding()
+                ):
+                    self.logger.info(
+                        "Receiver network binding changed. Stopping receiver; "
+                        "it will be re-initialised on the next start."
+                    )
+                    self.daq_instance.stop_daq()
+                    self._receiver_started = False
         # pylint: disable=broad-except
         except Exception as e:
             self.logger.error(f"Exception caught in `configure_daq`: {e}")
@@ -210,6 +491,16 @@ class DaqComponentManager(MccsComponentManager):
         # TODO: Raise some exception here? How do we want to deal with this?
         self.logger.info("DAQ receiver configuration complete.")
 
+    def _receiver_binding(self: DaqComponentManager) -> tuple[str, ...]:
+        """
+        Return the receiver's currently configured network binding.
+
+        :return: the configured values of the binding-determining keys,
+            stringified for comparison.
+        """
+        daq_config = self.daq_instance._config
+        return tuple(str(daq_config.get(key)) for key in self._RECEIVER_BINDING_KEYS)
+
     @check_communicating
     def start_daq(
         self: DaqComponentManager,
@@ -261,11 +552,17 @@ class DaqComponentManager(MccsComponentManager):
         :param task_callback: Update task state, defaults to None
         :param task_abort_event: Abort the task
         """
-        if not self._receiver_started:
-            self.daq_instance.initialise_daq()
-            self._receiver_started = True
         if task_callback:
             task_callback(status=TaskStatus.IN_PROGRESS)
+        # No-op when the background warm-up has already initialised the
+        # receiver; otherwise waits for (or performs) initialisation.
+        if not self._initialise_receiver():
+            if task_callback:
+                task_callback(
+                    status=TaskStatus.FAILED,
+                    message="Failed to initialise the DAQ receiver.",
+                )
+            return
         # Retrieve default list of modes to start if not provided.
         if modes_to_start is None:
             modes_to_start = self._get_consumers_to_start()
@@ -309,10 +606,229 @@ class DaqComponentManager(MccsComponentManager):
                 f"{self.daq_instance._config['receiver_ports']}"
             )
         )
+        # Wrap each callback (or provide one where none was supplied)
+        # so data arrival is pushed to the device as a change event.
+        if callbacks is None:
+            callbacks = [self._notifying_callback() for _ in modes_to_start]
+        else:
+            callbacks = [self._notifying_callback(callback) for callback in callbacks]
         self.daq_instance.start_daq(modes_to_start, callbacks)
         if task_callback:
             task_callback(status=TaskStatus.COMPLETED)
 
+    @check_communicating
+    def schedule_acquisition(
+        self: DaqComponentManager,
+        start_time: int,
+        duration: int,
+        modes_to_start: Optional[list[DaqModes]] = None,
+        task_callback: Optional[Callable] = None,
+    ) -> tuple[TaskStatus, str]:
+        """
+        Submit a task starting an acquisition window.
+
+        Requires acquisition-window support in the linked aavs_system
+        version; the vendored 1.1 wheel only forwards these settings to
+        its standalone CLI, not the consumer path.
+
+        :param start_time: Unix timestamp at which acquisition is to
+            begin. Buffer assembly is gated on the corresponding SPEAD
+            timestamps, not on when the consumers were started.
+        :param duration: Length of the acquisition window in seconds.
+            -1 acquires until stopped.
+        :param modes_to_start: The DAQ consumers to start.
+        :param task_callback: Update task state, defaults to None
+
+        :return: a task status and response message
+        """
+        self.logger.info("Submitting `_schedule_acquisition` task.")
+        return self.submit_task(
+            self._schedule_acquisition,
+            args=[start_time, duration, modes_to_start],
+            task_callback=task_callback,
+        )
+
+    def _schedule_acquisition(
+        self: DaqComponentManager,
+        start_time: int,
+        duration: int,
+        modes_to_start: Optional[list[DaqModes]] = None,
+        task_callback: Optional[Callable] = None,
+        task_abort_event: Union[threading.Event, None] = None,
+    ) -> None:
+        """
+        Start an acquisition window.
+
+        Applies the window to the DAQ configuration and starts the
+        requested consumers immediately. Enforcing the window against
+        SPEAD timestamps is the library's job: aavs_system versions with
+        window support advertise it via `supports_acquisition_windows`;
+        against older versions (including the vendored 1.1 wheel, whose
+        consumer path ignores these settings) the task fails rather
+        than silently acquiring immediately and forever.
+
+        :param start_time: Unix timestamp at which acquisition is to
+            begin.
+        :param duration: Length of the acquisition window in seconds.
+            -1 acquires until stopped.
+        :param modes_to_start: The DAQ consumers to start.
+        :param task_callback: Update task state, defaults to None
+        :param task_abort_event: Abort the task
+        """
+        if not getattr(self.daq_instance, "supports_acquisition_windows", False):
+            msg = (
+                "Acquisition windows are not supported by the linked "
+                "aavs_system version."
+            )
+            self.logger.error(msg)
+            if task_callback:
+                task_callback(status=TaskStatus.FAILED, message=msg)
+            return
+        self.configure_daq(
+            {
+                "acquisition_start_time": start_time,
+                "acquisition_duration": duration,
+            }
+        )
+        try:
+            self._start_daq(modes_to_start, None, task_callback=task_callback)
+        finally:
+            # The window settings persist in the library configuration;
+            # reset them so a subsequent plain start is not gated on a
+            # stale timestamp.
+            self.configure_daq(
+                {
+                    "acquisition_start_time": -1,
+                    "acquisition_duration": -1,
+                }
+            )
+
+    @check_communicating
+    def start_replay(
+        self: DaqComponentManager,
+        replay_file: str,
+        speed_factor: float = 0.0,
+        task_callback: Optional[Callable] = None,
+    ) -> tuple[TaskStatus, str]:
+        """
+        Submit a task replaying a previously captured file through DAQ.
+
+        :param replay_file: Path to a pcap or previously dumped raw
+            capture to feed through the consumer machinery.
+        :param speed_factor: Pacing multiple of the capture's line rate.
+            0 replays unthrottled.
+        :param task_callback: Update task state, defaults to None
+
+        :return: a task status and response message
+        """
+        if not replay_file:
+            return (TaskStatus.REJECTED, "No replay_file specified.")
+        self.logger.info("Submitting `_start_replay` task.")
+        return self.submit_task(
+            self._start_replay,
+            args=[replay_file, speed_factor],
+            task_callback=task_callback,
+        )
+
+    def _start_replay(
+        self: DaqComponentManager,
+        replay_file: str,
+        speed_factor: float,
+        task_callback: Optional[Callable] = None,
+        task_abort_event: Union[threading.Event, None] = None,
+    ) -> None:
+        """
+        Replay a previously captured file through DAQ.
+
+        The replay engine feeds the same ring-buffer/consumer machinery
+        as the live receiver, so the live receiver is stopped first.
+        `DaqReceiver.start_replay` itself attaches the currently
+        configured consumers to the replayed stream before pacing data
+        into the rings; this method starts no consumers of its own.
+
+        :param replay_file: Path to a pcap or previously dumped raw
+            capture to feed through the consumer machinery.
+        :param speed_factor: Pacing multiple of the capture's line rate.
+            0 replays unthrottled.
+        :param task_callback: Update task state, defaults to None
+        :param task_abort_event: Abort the task
+        """
+        if task_callback:
+            task_callback(status=TaskStatus.IN_PROGRESS)
+        start_replay = getattr(self.daq_instance, "start_replay", None)
+        if start_replay is None:
+            msg = "Replay is not supported by the linked aavs_system version."
+            self.logger.error(msg)
+            if task_callback:
+                task_callback(status=TaskStatus.FAILED, message=msg)
+            return
+        # Replay and live receive share the ring buffers and consumers.
+        with self._receiver_init_lock:
+            if self._receiver_started:
+                self.daq_instance.stop_daq()
+                self._receiver_started = False
+        self.logger.info(
+            f"Starting DAQ replay of {replay_file} "
+            f"at speed factor {speed_factor} (0 = unthrottled)."
+        )
+        start_replay(replay_file, speed_factor)
+        if task_callback:
+            task_callback(status=TaskStatus.COMPLETED)
+
+    @check_communicating
+    def profile_capture(
+        self: DaqComponentManager,
+        duration: float,
+        task_callback: Optional[Callable] = None,
+    ) -> tuple[TaskStatus, str]:
+        """
+        Submit a task capturing a profile of the receiver's hot paths.
+
+        :param duration: How long to sample for, in seconds.
+        :param task_callback: Update task state, defaults to None
+
+        :return: a task status and response message
+        """
+        self.logger.info("Submitting `_profile_capture` task.")
+        return self.submit_task(
+            self._profile_capture,
+            args=[duration],
+            task_callback=task_callback,
+        )
+
+    def _profile_capture(
+        self: DaqComponentManager,
+        duration: float,
+        task_callback: Optional[Callable] = None,
+        task_abort_event: Union[threading.Event, None] = None,
+    ) -> None:
+        """
+        Capture a sampling profile of the receiver's hot paths.
+
+        Sampling is performed by libaavsdaq's built-in profiler, which
+        covers packet dispatch, ring transfer and the consumer process
+        loops; it requires `capture_profile` support in the linked
+        aavs_system version. The profile is returned in folded-stack
+        form, ready for flame-graph rendering.
+
+        :param duration: How long to sample for, in seconds.
+        :param task_callback: Update task state, defaults to None
+        :param task_abort_event: Abort the task
+        """
+        if task_callback:
+            task_callback(status=TaskStatus.IN_PROGRESS)
+        capture_profile = getattr(self.daq_instance, "capture_profile", None)
+        if capture_profile is None:
+            msg = "Profiling is not supported by the linked aavs_system version."
+            self.logger.error(msg)
+            if task_callback:
+                task_callback(status=TaskStatus.FAILED, message=msg)
+            return
+        self.logger.info(f"Capturing receiver profile for {duration}s.")
+        profile = capture_profile(duration)
+        if task_callback:
+            task_callback(status=TaskStatus.COMPLETED, result=str(profile))
+
     def stop_daq(
         self: DaqComponentManager,
         task_callback: Optional[Callable] = None,
@@ -347,7 +863,16 @@ class DaqComponentManager(MccsComponentManager):
             "Stopping DAQ receiver listening on interface: "
             f"{self.daq_instance._config['receiver_interface']}"
         )
-        self.daq_instance.stop_daq()
-        self._receiver_started = False
+        # Newer aavs_system versions can stop all consumers while leaving
+        # the receiver bound and its block pool allocated, making the next
+        # `start_daq` a hot start. Fall back to a full stop (receiver
+        # included) for versions without that split lifecycle.
+        stop_consumers = getattr(self.daq_instance, "stop_consumers", None)
+        if stop_consumers is not None:
+            stop_consumers()
+        else:
+            with self._receiver_init_lock:
+                self.daq_instance.stop_daq()
+                self._receiver_started = False
         if task_callback:
             task_callback(status=TaskStatus.COMPLETED)
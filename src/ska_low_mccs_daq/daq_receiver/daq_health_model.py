@@ -19,6 +19,17 @@ __all__ = ["DaqHealthModel"]
 class DaqHealthModel(HealthModel):
     """A health model for a Daq receiver."""
 
+    # Weight of the newest drop fraction in the exponentially weighted
+    # average. At one poll per second, sustained loss dominates the
+    # average within a couple of seconds; single-poll blips do not.
+    _EWMA_ALPHA = 0.3
+
+    # Smoothed drop-fraction thresholds at which data-plane health
+    # becomes DEGRADED or FAILED. Recovery requires falling below half
+    # the onset threshold, so health does not flap at the boundary.
+    _DEGRADED_DROP_FRACTION = 1e-3
+    _FAILED_DROP_FRACTION = 5e-2
+
     def __init__(
         self: DaqHealthModel,
         component_state_changed_callback: Callable[[Any], None],
@@ -30,8 +41,67 @@ class DaqHealthModel(HealthModel):
             there is a change to this component's state, including the health
             model's evaluated health state.
         """
+        self._receiver_data_health = HealthState.OK
+        self._drop_rate_ewma = 0.0
+        self._last_receiver_stats: dict[str, Any] | None = None
         super().__init__(component_state_changed_callback)
 
+    def update_receiver_stats(
+        self: DaqHealthModel,
+        receiver_stats: dict[str, Any],
+    ) -> None:
+        """
+        Fold a new receiver statistics snapshot into health.
+
+        Evaluation is incremental: each snapshot contributes the delta
+        of its cumulative drop counters against the previous snapshot,
+        so the cost per update is O(1) regardless of polling rate.
+
+        :param receiver_stats: a snapshot of cumulative receiver
+            statistics, as returned by
+            :py:meth:`.DaqComponentManager.get_receiver_stats`. An empty
+            snapshot (statistics unsupported) leaves health unchanged.
+        """
+        if not receiver_stats:
+            return
+        last_stats = self._last_receiver_stats
+        self._last_receiver_stats = receiver_stats
+        if last_stats is None:
+            return
+
+        received = receiver_stats.get("packets_received", 0) - last_stats.get(
+            "packets_received", 0
+        )
+        dropped = (
+            receiver_stats.get("packets_dropped", 0)
+            - last_stats.get("packets_dropped", 0)
+            + receiver_stats.get("buffers_overflowed", 0)
+            - last_stats.get("buffers_overflowed", 0)
+        )
+        if received + dropped <= 0:
+            return
+        drop_fraction = dropped / (received + dropped)
+        self._drop_rate_ewma = (
+            self._EWMA_ALPHA * drop_fraction
+            + (1.0 - self._EWMA_ALPHA) * self._drop_rate_ewma
+        )
+
+        new_health = self._receiver_data_health
+        if self._drop_rate_ewma >= self._FAILED_DROP_FRACTION:
+            new_health = HealthState.FAILED
+        elif self._drop_rate_ewma >= self._DEGRADED_DROP_FRACTION:
+            if (
+                new_health != HealthState.FAILED
+                or self._drop_rate_ewma < self._FAILED_DROP_FRACTION / 2.0
+            ):
+                new_health = HealthState.DEGRADED
+        elif self._drop_rate_ewma < self._DEGRADED_DROP_FRACTION / 2.0:
+            new_health = HealthState.OK
+
+        if new_health != self._receiver_data_health:
+            self._receiver_data_health = new_health
+            self.update_health()
+
     def evaluate_health(
         self: DaqHealthModel,
     ) -> HealthState:
@@ -47,7 +117,7 @@ class DaqHealthModel(HealthModel):
             HealthState.UNKNOWN,
             HealthState.DEGRADED,
         ]:
-            if daq_health == health:
+            if daq_health == health or self._receiver_data_health == health:
                 return health
 
         return HealthState.OK
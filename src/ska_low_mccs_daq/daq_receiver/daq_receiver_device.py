@@ -22,7 +22,7 @@ from ska_tango_base.commands import (
     ResultCode,
     SubmittedSlowCommand,
 )
-from tango.server import command, device_property
+from tango.server import attribute, command, device_property
 
 from ska_low_mccs_daq.daq_receiver.daq_component_manager import DaqComponentManager
 from ska_low_mccs_daq.daq_receiver.daq_health_model import DaqHealthModel
@@ -61,6 +61,36 @@ class MccsDaqReceiver(SKABaseDevice):
     ConsumersToStart = device_property(
         dtype=str, doc="The default consumer list to start.", default_value=""
     )
+    ReceiverBackend = device_property(
+        dtype=str,
+        mandatory=False,
+        doc="The receive engine the DAQ receiver is to use, e.g. 'af_xdp'. "
+        "An empty string selects the library default (raw-socket) path.",
+        default_value="",
+    )
+    ReceiverCpuSet = device_property(
+        dtype=str,
+        mandatory=False,
+        doc="A comma separated list of CPUs the receiver threads are to be "
+        "pinned to, e.g. '2,4,6'. An empty string leaves placement to the "
+        "library.",
+        default_value="",
+    )
+    ReceiverNumaNode = device_property(
+        dtype=int,
+        mandatory=False,
+        doc="The NUMA node the receiver ring blocks are to be allocated on, "
+        "normally the NIC-local node. -1 leaves placement to the library.",
+        default_value=-1,
+    )
+    ReceiverHugepages = device_property(
+        dtype=bool,
+        mandatory=False,
+        doc="Whether to back the receiver rings and consumer buffers with "
+        "mlocked 2 MiB huge pages. Requires libaavsdaq support and "
+        "cap_ipc_lock (granted in the Dockerfile).",
+        default_value=False,
+    )
 
     # ---------------
     # Initialisation
@@ -99,7 +129,9 @@ class MccsDaqReceiver(SKABaseDevice):
         super()._init_state_model()
         self._health_state = HealthState.UNKNOWN  # InitCommand.do() does this too late.
         self._health_model = DaqHealthModel(self._component_state_changed_callback)
+        self._data_received: str = "{}"
         self.set_change_event("healthState", True, False)
+        self.set_change_event("dataReceived", True, False)
 
     def create_component_manager(self: MccsDaqReceiver) -> DaqComponentManager:
         """
@@ -117,6 +149,10 @@ class MccsDaqReceiver(SKABaseDevice):
             self._max_workers,
             self._component_communication_state_changed,
             self._component_state_changed_callback,
+            receiver_backend=self.ReceiverBackend,
+            receiver_cpu_set=self.ReceiverCpuSet,
+            receiver_numa_node=self.ReceiverNumaNode,
+            receiver_hugepages=self.ReceiverHugepages,
         )
 
     def init_command_objects(self: MccsDaqReceiver) -> None:
@@ -126,6 +162,7 @@ class MccsDaqReceiver(SKABaseDevice):
         for (command_name, command_object) in [
             ("Configure", self.ConfigureCommand),
             ("SetConsumers", self.SetConsumersCommand),
+            ("TriggerAntennaBuffer", self.TriggerAntennaBufferCommand),
             ("DaqStatus", self.DaqStatusCommand),
             ("GetConfiguration", self.GetConfigurationCommand),
         ]:
@@ -137,6 +174,9 @@ class MccsDaqReceiver(SKABaseDevice):
         for (command_name, method_name) in [
             ("Start", "start_daq"),
             ("Stop", "stop_daq"),
+            ("StartReplay", "start_replay"),
+            ("ScheduleAcquisition", "schedule_acquisition"),
+            ("ProfileCapture", "profile_capture"),
         ]:
             self.register_command_object(
                 command_name,
@@ -229,6 +269,15 @@ class MccsDaqReceiver(SKABaseDevice):
                 self._health_state = cast(HealthState, health)
                 self.push_change_event("healthState", health)
 
+        if "receiver_stats" in state_change.keys():
+            self._health_model.update_receiver_stats(
+                state_change.get("receiver_stats")
+            )
+
+        if "dataReceived" in state_change.keys():
+            self._data_received = json.dumps(state_change.get("dataReceived"))
+            self.push_change_event("dataReceived", self._data_received)
+
     # ----------
     # Attributes
     # ----------
@@ -267,6 +316,90 @@ class MccsDaqReceiver(SKABaseDevice):
     #     """
     #     return self._component_manager._some_attribute
 
+    @attribute(dtype="DevString", label="Last data received")
+    def dataReceived(self: MccsDaqReceiver) -> str:
+        """
+        Return the most recent data-arrival notification as a json string.
+
+        The notification carries the data mode, file name and any
+        consumer-specific extra information. A change event is pushed on
+        this attribute whenever a consumer persists a new data product,
+        so clients can subscribe instead of polling the filesystem.
+
+        :return: the most recent data-arrival notification.
+        """
+        return self._data_received
+
+    @attribute(dtype="DevLong64", label="Packets received")
+    def packetsReceived(self: MccsDaqReceiver) -> int:
+        """
+        Return the number of packets received across all receiver ports.
+
+        Zero if the linked aavs_system does not support statistics
+        collection.
+
+        :return: the number of packets received.
+        """
+        return int(
+            self.component_manager.get_receiver_stats().get("packets_received", 0)
+        )
+
+    @attribute(dtype="DevLong64", label="Packets dropped")
+    def packetsDropped(self: MccsDaqReceiver) -> int:
+        """
+        Return the number of packets dropped across all receiver ports.
+
+        Zero if the linked aavs_system does not support statistics
+        collection.
+
+        :return: the number of packets dropped.
+        """
+        return int(
+            self.component_manager.get_receiver_stats().get("packets_dropped", 0)
+        )
+
+    @attribute(dtype="DevLong64", label="Buffers processed")
+    def buffersProcessed(self: MccsDaqReceiver) -> int:
+        """
+        Return the number of buffers processed across all consumers.
+
+        Zero if the linked aavs_system does not support statistics
+        collection.
+
+        :return: the number of buffers processed.
+        """
+        return int(
+            self.component_manager.get_receiver_stats().get("buffers_processed", 0)
+        )
+
+    @attribute(dtype="DevLong64", label="Buffers overflowed")
+    def buffersOverflowed(self: MccsDaqReceiver) -> int:
+        """
+        Return the number of buffers overflowed across all consumers.
+
+        Zero if the linked aavs_system does not support statistics
+        collection.
+
+        :return: the number of buffers overflowed.
+        """
+        return int(
+            self.component_manager.get_receiver_stats().get("buffers_overflowed", 0)
+        )
+
+    @attribute(dtype="DevString", label="Receiver statistics")
+    def receiverStats(self: MccsDaqReceiver) -> str:
+        """
+        Return all receiver statistics as a json string.
+
+        This includes the per-port and per-consumer breakdowns and the
+        callback latency percentiles, which do not map onto scalar
+        attributes. An empty dictionary is returned if the linked
+        aavs_system does not support statistics collection.
+
+        :return: A json string containing all receiver statistics.
+        """
+        return json.dumps(self.component_manager.get_receiver_stats())
+
     # --------
     # Commands
     # --------
@@ -375,6 +508,98 @@ class MccsDaqReceiver(SKABaseDevice):
         (result_code, message) = handler(modes_to_start, callbacks)
         return ([result_code], [message])
 
+    @command(dtype_in="DevString", dtype_out="DevVarLongStringArray")
+    def ScheduleAcquisition(
+        self: MccsDaqReceiver, argin: str
+    ) -> DevVarLongStringArrayType:
+        """
+        Schedule a timestamp-aligned acquisition window.
+
+        Starts the requested consumers with an acquisition window applied,
+        gated in the receiving library against SPEAD timestamps rather than
+        wall-clock calls from Python. Requires acquisition-window support
+        in the linked aavs_system version; against older versions the task
+        fails instead of acquiring immediately and indefinitely.
+
+        :param argin: JSON-formatted string containing the Unix timestamp
+            at which acquisition is to begin ("start_time", required),
+            the window length in seconds ("duration", -1 = until
+            stopped) and optionally the DaqModes to start
+            ("modes_to_start").
+
+        :return: A tuple containing a return code and a string
+            message indicating status. The message is for
+            information purpose only.
+        """
+        handler = self.get_command_object("ScheduleAcquisition")
+        params = json.loads(argin) if argin else {}
+
+        if "start_time" not in params:
+            # -1 means "no window" to the library, so defaulting it
+            # would silently degrade to an immediate run-forever start.
+            return ([ResultCode.REJECTED], ["No start_time specified."])
+        start_time = params["start_time"]
+        duration = params.get("duration", -1)
+        modes_to_start = params.get("modes_to_start", None)
+
+        (result_code, message) = handler(start_time, duration, modes_to_start)
+        return ([result_code], [message])
+
+    @command(dtype_in="DevString", dtype_out="DevVarLongStringArray")
+    def StartReplay(self: MccsDaqReceiver, argin: str) -> DevVarLongStringArrayType:
+        """
+        Replay a previously captured file through the configured consumers.
+
+        The live receiver is stopped; the replay engine in the receiving
+        library then attaches the currently configured consumers itself
+        and feeds the capture through them, unthrottled or at a pacing
+        multiple of line rate, so captured data can be reprocessed (e.g.
+        re-correlated) without hardware. Requires replay support in the
+        linked aavs_system version.
+
+        :param argin: JSON-formatted string containing the path to the
+            capture ("replay_file") and optionally a pacing multiple
+            ("speed_factor", 0 = unthrottled).
+
+        :return: A tuple containing a return code and a string
+            message indicating status. The message is for
+            information purpose only.
+        """
+        handler = self.get_command_object("StartReplay")
+        params = json.loads(argin) if argin else {}
+
+        replay_file = params.get("replay_file")
+        speed_factor = params.get("speed_factor", 0.0)
+
+        (result_code, message) = handler(replay_file, speed_factor)
+        return ([result_code], [message])
+
+    @command(dtype_in="DevString", dtype_out="DevVarLongStringArray")
+    def ProfileCapture(self: MccsDaqReceiver, argin: str) -> DevVarLongStringArrayType:
+        """
+        Capture a sampling profile of the receiver's hot paths.
+
+        Samples the receiving library under real load for the requested
+        duration and makes a flame-graph-ready folded-stack profile
+        available as the command result, so throughput collapses can be
+        diagnosed in place instead of reproduced in a lab. Requires
+        profiling support in the linked aavs_system version.
+
+        :param argin: JSON-formatted string containing how long to
+            sample for in seconds ("duration").
+
+        :return: A tuple containing a return code and a string
+            message indicating status. The message is for
+            information purpose only.
+        """
+        handler = self.get_command_object("ProfileCapture")
+        params = json.loads(argin) if argin else {}
+
+        duration = params.get("duration", 10.0)
+
+        (result_code, message) = handler(duration)
+        return ([result_code], [message])
+
     @command(dtype_out="DevVarLongStringArray")
     def Stop(self: MccsDaqReceiver) -> DevVarLongStringArrayType:
         """
@@ -548,6 +773,58 @@ class MccsDaqReceiver(SKABaseDevice):
         (result_code, message) = handler(argin)
         return ([result_code], [message])
 
+    # pylint: disable=too-few-public-methods
+    class TriggerAntennaBufferCommand(FastCommand):
+        """Class for handling the TriggerAntennaBuffer() command."""
+
+        def __init__(  # type: ignore
+            self: MccsDaqReceiver.TriggerAntennaBufferCommand,
+            component_manager,
+            logger: Optional[logging.Logger] = None,
+        ) -> None:
+            """
+            Initialise a new TriggerAntennaBufferCommand instance.
+
+            :param component_manager: the device to which this command belongs.
+            :param logger: a logger for this command to use.
+            """
+            self._component_manager = component_manager
+            super().__init__(logger)
+
+        # pylint: disable=arguments-differ
+        def do(  # type: ignore[override]
+            self: MccsDaqReceiver.TriggerAntennaBufferCommand,
+        ) -> tuple[ResultCode, str]:
+            """
+            Implement MccsDaqReceiver.TriggerAntennaBuffer command functionality.
+
+            :return: A tuple containing a return code and a string
+                message indicating status. The message is for
+                information purpose only.
+            """
+            (success, message) = self._component_manager.trigger_antenna_buffer()
+            if success:
+                return (ResultCode.OK, message)
+            return (ResultCode.FAILED, message)
+
+    @command(dtype_out="DevVarLongStringArray")
+    def TriggerAntennaBuffer(self: MccsDaqReceiver) -> DevVarLongStringArrayType:
+        """
+        Dump the antenna buffer's held samples to disk.
+
+        When the antenna buffer consumer is running in triggered mode it
+        holds the most recent seconds of antenna data in memory; this
+        command dumps that window to disk, for example on receipt of a
+        transient alert.
+
+        :return: A tuple containing a return code and a string
+            message indicating status. The message is for
+            information purpose only.
+        """
+        handler = self.get_command_object("TriggerAntennaBuffer")
+        (result_code, message) = handler()
+        return ([result_code], [message])
+
     # @command(dtype_in="DevString", dtype_out="DevVarLongStringArray")
     # def Command(self: XXXXXX, argin: str) -> DevVarLongStringArrayType:
     #     """"""
@@ -0,0 +1,154 @@
+# -*- coding: utf-8 -*-
+#
+# This file is part of the SKA Low MCCS project
+#
+#
+# Distributed under the terms of the BSD 3-clause new license.
+# See LICENSE for more info.
+"""
+This module implements a SPEAD packet generator for benchmarking DAQ.
+
+The generator synthesises TPM LMC SPEAD packets (the same header layout
+that `pyaavs.tests.spead_beam_power_offline` decodes) and transmits them
+over UDP at a configurable data rate, so a deployed MccsDaqReceiver can
+be driven at load without TPM hardware. It is pure Python and therefore
+tops out well below 40GbE line rate; qualifying a libaavsdaq build at
+full line rate additionally needs the native packet generator tracked in
+aavs-system.
+"""
+from __future__ import annotations
+
+import socket
+import struct
+import time
+
+__all__ = ["SpeadPacketGenerator"]
+
+
+class SpeadPacketGenerator:
+    """A generator of TPM LMC SPEAD packets for benchmarking DAQ."""
+
+    # pylint: disable=too-many-arguments
+    def __init__(
+        self: SpeadPacketGenerator,
+        dest_ip: str,
+        dest_port: int = 4660,
+        payload_size: int = 8192,
+        capture_mode: int = 0,
+        tpm_id: int = 0,
+        station_id: int = 0,
+    ) -> None:
+        """
+        Initialise a new instance of SpeadPacketGenerator.
+
+        :param dest_ip: The IP address the DAQ receiver is monitoring.
+        :param dest_port: The port the DAQ receiver is monitoring.
+        :param payload_size: Number of payload bytes per packet.
+        :param capture_mode: LMC capture mode item value (consumer
+            dependent).
+        :param tpm_id: The TPM id to stamp packets with.
+        :param station_id: The station id to stamp packets with.
+        """
+        self._dest = (dest_ip, dest_port)
+        self._payload_size = payload_size
+        self._capture_mode = capture_mode
+        self._tpm_id = tpm_id
+        self._station_id = station_id
+        self._sync_time = int(time.time())
+
+    def _build_packet(
+        self: SpeadPacketGenerator,
+        packet_counter: int,
+        channel_id: int = 0,
+    ) -> bytes:
+        """
+        Build a single LMC SPEAD packet.
+
+        The header layout matches what the TPM firmware emits and the
+        libaavsdaq consumers parse: magic, heap counter, payload length,
+        sync time, timestamp, capture mode, channel info, TPM info and
+        payload offset, followed by the payload.
+
+        :param packet_counter: Heap counter value for this packet.
+        :param channel_id: Logical channel id for this packet.
+
+        :return: the packet, ready to send.
+        """
+        heap_counter = (
+            (0x8001 << 48)
+            | ((channel_id & 0xFFFF) << 32)
+            | (packet_counter & 0xFFFFFFFF)
+        )
+        tpm_info = (
+            (0xA001 << 48)
+            | ((self._tpm_id & 0xF) << 32)
+            | ((self._station_id & 0xFFFF) << 16)
+        )
+        header = struct.pack(
+            ">9Q",
+            0x5304020600000008,
+            heap_counter,
+            (0x8004 << 48) | self._payload_size,
+            (0x9027 << 48) | self._sync_time,
+            (0x9600 << 48) | (int(time.time()) & 0xFFFFFFFFFFFF),
+            (0xA004 << 48) | self._capture_mode,
+            (0xA002 << 48) | (channel_id & 0xFFFF),
+            tpm_info,
+            (0x3300 << 48),
+        )
+        return header + bytes(self._payload_size)
+
+    def send(
+        self: SpeadPacketGenerator,
+        duration: float,
+        data_rate_gbps: float,
+        nof_channels: int = 1,
+    ) -> dict[str, float]:
+        """
+        Transmit packets at the requested rate for the requested time.
+
+        Pacing is checked every few hundred packets, which is accurate
+        enough at the rates a Python sender can reach.
+
+        :param duration: How long to transmit for, in seconds.
+        :param data_rate_gbps: The target data rate in Gb/s.
+        :param nof_channels: Number of logical channels to cycle
+            through.
+
+        :return: a report containing the number of packets and bytes
+            sent, the elapsed time and the achieved rate in Gb/s.
+        """
+        sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        packet_size = 9 * 8 + self._payload_size
+        packets_per_second = (data_rate_gbps * 1e9 / 8.0) / packet_size
+        pacing_batch = 256
+
+        packets_sent = 0
+        start = time.perf_counter()
+        deadline = start + duration
+        now = start
+        while now < deadline:
+            for _ in range(pacing_batch):
+                sock.sendto(
+                    self._build_packet(
+                        packets_sent, packets_sent % nof_channels
+                    ),
+                    self._dest,
+                )
+                packets_sent += 1
+            now = time.perf_counter()
+            # Sleep off any lead over the target rate.
+            ahead = packets_sent / packets_per_second - (now - start)
+            if ahead > 0:
+                time.sleep(ahead)
+                now = time.perf_counter()
+        sock.close()
+
+        elapsed = now - start
+        bytes_sent = packets_sent * packet_size
+        return {
+            "packets_sent": packets_sent,
+            "bytes_sent": bytes_sent,
+            "elapsed": elapsed,
+            "achieved_gbps": bytes_sent * 8.0 / elapsed / 1e9,
+        }
@@ -0,0 +1,100 @@
+# -*- coding: utf-8 -*-
+#
+# This file is part of the SKA Low MCCS project
+#
+#
+# Distributed under the terms of the BSD 3-clause new license.
+# See LICENSE for more info.
+"""
+This module contains the DAQ benchmark and loss-regression test.
+
+It drives a deployed MccsDaqReceiver with synthetic SPEAD traffic from
+:py:mod:`tests.functional.packet_generator` and fails if the receiver
+reports packet loss above a threshold, so a new image can be qualified
+in minutes instead of on the telescope. The test is tunable through
+environment variables:
+
+* ``DAQ_BENCHMARK_RATE_GBPS``: target data rate (default 1.0)
+* ``DAQ_BENCHMARK_DURATION``: seconds of traffic to send (default 10)
+* ``DAQ_BENCHMARK_MAX_LOSS``: highest acceptable loss fraction
+  (default 0.0)
+"""
+from __future__ import annotations
+
+import json
+import os
+from time import sleep
+
+import pytest
+import tango
+from ska_tango_testing.context import TangoContextProtocol
+
+from tests.functional.packet_generator import SpeadPacketGenerator
+
+
+@pytest.fixture(name="daq_receiver")
+def daq_receiver_fixture(
+    tango_harness: TangoContextProtocol,
+    daq_name: str,
+) -> tango.DeviceProxy:
+    """
+    Return the daq_receiver device.
+
+    :param tango_harness: a test harness for tango devices
+    :param daq_name: name of the DAQ receiver Tango device
+
+    :return: the daq_receiver device
+    """
+    return tango_harness.get_device(daq_name)
+
+
+@pytest.mark.needs_tangodb
+def test_sustained_rate_without_loss(
+    daq_receiver: tango.DeviceProxy,
+) -> None:
+    """
+    Drive the DAQ receiver with synthetic SPEAD traffic and check loss.
+
+    The loss check needs the receiver statistics surface; when the
+    deployed aavs_system predates it the test reports the achieved
+    generator rate and skips, rather than passing vacuously.
+
+    :param daq_receiver: The daq_receiver fixture to use.
+    """
+    data_rate_gbps = float(os.environ.get("DAQ_BENCHMARK_RATE_GBPS", "1.0"))
+    duration = float(os.environ.get("DAQ_BENCHMARK_DURATION", "10"))
+    max_loss = float(os.environ.get("DAQ_BENCHMARK_MAX_LOSS", "0.0"))
+
+    status = json.loads(daq_receiver.DaqStatus())
+    receiver_ip = status["Receiver IP"][0]
+    receiver_port = int(status["Receiver Ports"][0])
+
+    baseline_stats = json.loads(daq_receiver.receiverStats)
+    if not baseline_stats:
+        pytest.skip(
+            "Receiver statistics are not supported by the deployed "
+            "aavs_system version; cannot measure loss."
+        )
+
+    generator = SpeadPacketGenerator(receiver_ip, receiver_port)
+    report = generator.send(duration, data_rate_gbps)
+    # Let the receiver drain its rings before reading final counters.
+    sleep(2)
+
+    stats = json.loads(daq_receiver.receiverStats)
+    packets_received = stats.get("packets_received", 0) - baseline_stats.get(
+        "packets_received", 0
+    )
+    packets_dropped = stats.get("packets_dropped", 0) - baseline_stats.get(
+        "packets_dropped", 0
+    )
+    loss = 1.0 - packets_received / report["packets_sent"]
+
+    print(
+        f"Sent {report['packets_sent']} packets "
+        f"({report['achieved_gbps']:.3f} Gb/s achieved of "
+        f"{data_rate_gbps} Gb/s target); "
+        f"received {packets_received}, dropped {packets_dropped}, "
+        f"loss fraction {loss:.6f}"
+    )
+    assert loss <= max_loss
@@ -189,6 +189,13 @@ def mock_component_manager_fixture(
     configuration = {
         "start_daq.return_value": (TaskStatus.QUEUED, "Task queued"),
         "stop_daq.return_value": (TaskStatus.QUEUED, "Task queued"),
+        "start_replay.return_value": (TaskStatus.QUEUED, "Task queued"),
+        "schedule_acquisition.return_value": (TaskStatus.QUEUED, "Task queued"),
+        "trigger_antenna_buffer.return_value": (
+            True,
+            "TriggerAntennaBuffer command completed OK",
+        ),
+        "profile_capture.return_value": (TaskStatus.QUEUED, "Task queued"),
     }
     mock_component_manager.configure_mock(**configuration)
     return mock_component_manager
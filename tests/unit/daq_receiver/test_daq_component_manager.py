@@ -299,6 +299,169 @@ class TestDaqComponentManager:
         daq_component_manager._set_consumers_to_start(consumer_list)
         assert daq_component_manager._get_consumers_to_start() == daq_modes
 
+    def test_unsupported_config_keys_dropped(
+        self: TestDaqComponentManager,
+        daq_component_manager: DaqComponentManager,
+    ) -> None:
+        """
+        Test that optional config keys unknown to pydaq are dropped.
+
+        The `receiver_backend` key is only recognised by aavs_system versions
+        with a selectable receive engine. When the linked version does not
+        recognise it, it must be dropped from the configuration (with a
+        warning) rather than failing configuration outright.
+
+        :param daq_component_manager: the daq receiver component manager
+            under test.
+        """
+        daq_component_manager._receiver_backend = "af_xdp"
+        daq_config = daq_component_manager._get_daq_config()
+        if "receiver_backend" in daq_component_manager.daq_instance._config:
+            assert daq_config["receiver_backend"] == "af_xdp"
+        else:
+            assert "receiver_backend" not in daq_config
+
+    def test_reconfigure_rebinds_receiver(
+        self: TestDaqComponentManager,
+        daq_component_manager: DaqComponentManager,
+    ) -> None:
+        """
+        Test that changing the network binding stops the started receiver.
+
+        A configuration that changes binding-determining keys (here the
+        receiver ports) must stop the running receiver and mark it for
+        re-initialisation on the next start, whereas a configuration that
+        leaves the binding alone must not.
+
+        :param daq_component_manager: the daq receiver component manager
+            under test.
+        """
+        # Wait for the background warm-up to initialise the receiver.
+        daq_component_manager._initialise_receiver()
+        assert daq_component_manager._receiver_started
+
+        # No binding keys changed: the receiver stays up.
+        daq_component_manager.configure_daq({"acquisition_duration": 2})
+        assert daq_component_manager._receiver_started
+
+        # Binding changed: the receiver is stopped pending re-initialisation.
+        daq_component_manager.configure_daq({"receiver_ports": "4661"})
+        assert not daq_component_manager._receiver_started
+
+    def test_start_replay_requires_file(
+        self: TestDaqComponentManager,
+        daq_component_manager: DaqComponentManager,
+        callbacks: MockCallableGroup,
+    ) -> None:
+        """
+        Test that a replay request without a file is rejected.
+
+        :param daq_component_manager: the daq receiver component manager
+            under test.
+        :param callbacks: a dictionary from which callbacks with
+            asynchrony support can be accessed.
+        """
+        daq_component_manager.start_communicating()
+        callbacks["communication_state"].assert_call(
+            CommunicationStatus.NOT_ESTABLISHED
+        )
+        callbacks["communication_state"].assert_call(CommunicationStatus.ESTABLISHED)
+
+        rc, message = daq_component_manager.start_replay("")
+        assert rc == TaskStatus.REJECTED
+        assert message == "No replay_file specified."
+
+    def test_schedule_acquisition_unsupported(
+        self: TestDaqComponentManager,
+        daq_component_manager: DaqComponentManager,
+        callbacks: MockCallableGroup,
+    ) -> None:
+        """
+        Test that an acquisition window fails without library support.
+
+        Where the linked aavs_system does not advertise
+        `supports_acquisition_windows`, the task must fail with a clear
+        message rather than acquiring immediately and indefinitely.
+
+        :param daq_component_manager: the daq receiver component manager
+            under test.
+        :param callbacks: a dictionary from which callbacks with
+            asynchrony support can be accessed.
+        """
+        if getattr(
+            daq_component_manager.daq_instance,
+            "supports_acquisition_windows",
+            False,
+        ):
+            pytest.skip("The linked aavs_system supports acquisition windows.")
+        daq_component_manager._schedule_acquisition(
+            1234567890, 30, None, task_callback=callbacks["task"]
+        )
+        callbacks["task"].assert_call(
+            status=TaskStatus.FAILED,
+            message=(
+                "Acquisition windows are not supported by the linked "
+                "aavs_system version."
+            ),
+        )
+
+    def test_data_received_notification(
+        self: TestDaqComponentManager,
+        daq_component_manager: DaqComponentManager,
+        callbacks: MockCallableGroup,
+    ) -> None:
+        """
+        Test that consumer callbacks are bridged to the device.
+
+        The wrapped callback must notify the component state callback
+        with the data mode and file name, and must still call any
+        externally supplied callback with the original arguments. The
+        forwarding thread only runs while communication is established.
+
+        :param daq_component_manager: the daq receiver component manager
+            under test.
+        :param callbacks: a dictionary from which callbacks with
+            asynchrony support can be accessed.
+        """
+        daq_component_manager.start_communicating()
+        callbacks["communication_state"].assert_call(
+            CommunicationStatus.NOT_ESTABLISHED
+        )
+        callbacks["communication_state"].assert_call(CommunicationStatus.ESTABLISHED)
+
+        wrapped = daq_component_manager._notifying_callback(callbacks["task"])
+        wrapped("burst_raw", "raw_data.hdf5", 2)
+
+        callbacks["task"].assert_call("burst_raw", "raw_data.hdf5", 2)
+        callbacks["component_state"].assert_call(
+            {
+                "dataReceived": {
+                    "data_mode": "burst_raw",
+                    "file_name": "raw_data.hdf5",
+                    "additional_info": "2",
+                }
+            }
+        )
+
+    def test_get_receiver_stats(
+        self: TestDaqComponentManager,
+        daq_component_manager: DaqComponentManager,
+    ) -> None:
+        """
+        Test that receiver statistics are fetched or degrade gracefully.
+
+        Where the linked aavs_system exposes `get_receiver_stats` we expect
+        a dictionary of statistics; for older versions we expect an empty
+        dictionary rather than an error.
+
+        :param daq_component_manager: the daq receiver component manager
+            under test.
+        """
+        receiver_stats = daq_component_manager.get_receiver_stats()
+        assert isinstance(receiver_stats, dict)
+        if not hasattr(daq_component_manager.daq_instance, "get_receiver_stats"):
+            assert receiver_stats == {}
+
     # def test_validate_daq_config(self: TestDaqComponentManager,
     #     daq_component_manager: DaqComponentManager,) -> None:
     #     """
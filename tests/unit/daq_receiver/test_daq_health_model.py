@@ -0,0 +1,140 @@
+# -*- coding: utf-8 -*-
+#
+# This file is part of the SKA Low MCCS project
+#
+#
+# Distributed under the terms of the BSD 3-clause new license.
+# See LICENSE for more info.
+"""This module contains the tests for the DaqHealthModel."""
+from __future__ import annotations
+
+from typing import Any
+
+import pytest
+from ska_control_model import HealthState
+
+from ska_low_mccs_daq.daq_receiver.daq_health_model import DaqHealthModel
+
+
+@pytest.fixture(name="health_model")
+def health_model_fixture() -> DaqHealthModel:
+    """
+    Return a health model with a no-op component state callback.
+
+    :return: a health model for testing.
+    """
+
+    def _component_state_changed_callback(state_change: dict[str, Any]) -> None:
+        pass
+
+    return DaqHealthModel(_component_state_changed_callback)
+
+
+def _stats(packets_received: int, packets_dropped: int) -> dict[str, int]:
+    """
+    Return a receiver statistics snapshot with the given counters.
+
+    :param packets_received: cumulative packets received.
+    :param packets_dropped: cumulative packets dropped.
+
+    :return: a receiver statistics snapshot.
+    """
+    return {
+        "packets_received": packets_received,
+        "packets_dropped": packets_dropped,
+        "buffers_overflowed": 0,
+    }
+
+
+class TestDaqHealthModel:
+    """Tests of the DaqHealthModel."""
+
+    def test_empty_stats_leave_health_unchanged(
+        self: TestDaqHealthModel,
+        health_model: DaqHealthModel,
+    ) -> None:
+        """
+        Test that unsupported (empty) statistics do not affect health.
+
+        :param health_model: the health model under test.
+        """
+        health_model.update_receiver_stats({})
+        assert health_model._receiver_data_health == HealthState.OK
+
+    def test_transient_blip_does_not_degrade(
+        self: TestDaqHealthModel,
+        health_model: DaqHealthModel,
+    ) -> None:
+        """
+        Test that a single lossy poll among clean ones keeps health OK.
+
+        The exponentially weighted average must smooth over one poll of
+        mild loss surrounded by clean polls.
+
+        :param health_model: the health model under test.
+        """
+        health_model.update_receiver_stats(_stats(1_000_000, 0))
+        health_model.update_receiver_stats(_stats(2_000_000, 1))
+        assert health_model._receiver_data_health == HealthState.OK
+        for poll in range(3, 10):
+            health_model.update_receiver_stats(_stats(poll * 1_000_000, 1))
+            assert health_model._receiver_data_health == HealthState.OK
+
+    def test_sustained_loss_degrades_then_fails(
+        self: TestDaqHealthModel,
+        health_model: DaqHealthModel,
+    ) -> None:
+        """
+        Test that sustained loss reaches DEGRADED and then FAILED.
+
+        With 2% of packets dropped every poll, the smoothed drop rate
+        must cross the DEGRADED threshold within a couple of polls;
+        when loss worsens to 30% per poll, FAILED must follow.
+
+        :param health_model: the health model under test.
+        """
+        health_model.update_receiver_stats(_stats(1_000_000, 0))
+        for poll in range(1, 4):
+            health_model.update_receiver_stats(
+                _stats(1_000_000 + poll * 980_000, poll * 20_000)
+            )
+        assert health_model._receiver_data_health == HealthState.DEGRADED
+
+        received = 1_000_000 + 3 * 980_000
+        for poll in range(1, 10):
+            health_model.update_receiver_stats(
+                _stats(received + poll * 700_000, 3 * 20_000 + poll * 300_000)
+            )
+        assert health_model._receiver_data_health == HealthState.FAILED
+        assert health_model.evaluate_health() == HealthState.FAILED
+
+    def test_recovery_with_hysteresis(
+        self: TestDaqHealthModel,
+        health_model: DaqHealthModel,
+    ) -> None:
+        """
+        Test that health recovers only once loss stays well below onset.
+
+        After sustained loss has driven health to FAILED, clean polls
+        must bring it back through DEGRADED to OK, and the recovery
+        thresholds sit below the onset thresholds so health does not
+        flap at the boundary.
+
+        :param health_model: the health model under test.
+        """
+        health_model.update_receiver_stats(_stats(1_000_000, 0))
+        for poll in range(1, 10):
+            health_model.update_receiver_stats(
+                _stats(1_000_000 + poll * 700_000, poll * 300_000)
+            )
+        assert health_model._receiver_data_health == HealthState.FAILED
+
+        base_received = 1_000_000 + 9 * 700_000
+        seen = []
+        for poll in range(1, 40):
+            health_model.update_receiver_stats(
+                _stats(base_received + poll * 1_000_000, 9 * 300_000)
+            )
+            seen.append(health_model._receiver_data_health)
+        assert HealthState.DEGRADED in seen
+        assert seen[-1] == HealthState.OK
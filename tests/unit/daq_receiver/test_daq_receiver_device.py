@@ -334,3 +334,182 @@ class TestPatchedDaq:
         # it's what we expect.
         call_args = mock_component_manager._set_consumers_to_start.call_args
         assert call_args.args[0] == consumer_list
+
+    def test_schedule_acquisition_device(
+        self: TestPatchedDaq,
+        device_under_test: tango.DeviceProxy,
+        mock_component_manager: unittest.mock.Mock,
+    ) -> None:
+        """
+        Test for ScheduleAcquisition().
+
+        This tests that when we pass a valid json string to the
+        `ScheduleAcquisition` command it is parsed into the proper
+        parameters for `schedule_acquisition`.
+
+        :param device_under_test: fixture that provides a
+            :py:class:`tango.DeviceProxy` to the device under test, in a
+            :py:class:`tango.test_context.DeviceTestContext`.
+        :param mock_component_manager: a mock component manager that has
+            been patched into the device under test
+        """
+        device_under_test.adminMode = AdminMode.ONLINE
+
+        argin = {
+            "start_time": 1234567890,
+            "duration": 30,
+            "modes_to_start": [DaqModes.STATION_BEAM_DATA],
+        }
+        [result_code], [response] = device_under_test.ScheduleAcquisition(
+            json.dumps(argin)
+        )
+
+        assert result_code == ResultCode.QUEUED
+        assert "ScheduleAcquisition" in response.split("_")[-1]
+
+        call_args = mock_component_manager.schedule_acquisition.call_args
+        assert call_args.args[0] == 1234567890
+        assert call_args.args[1] == 30
+        assert call_args.args[2] == [DaqModes.STATION_BEAM_DATA]
+
+        # A window without a start time is rejected rather than
+        # degrading to an immediate run-forever acquisition.
+        argin = {"duration": 30}
+        [result_code], [response] = device_under_test.ScheduleAcquisition(
+            json.dumps(argin)
+        )
+        assert result_code == ResultCode.REJECTED
+        assert response == "No start_time specified."
+
+    def test_start_replay_device(
+        self: TestPatchedDaq,
+        device_under_test: tango.DeviceProxy,
+        mock_component_manager: unittest.mock.Mock,
+    ) -> None:
+        """
+        Test for StartReplay().
+
+        This tests that when we pass a valid json string to the
+        `StartReplay` command it is parsed into the proper parameters for
+        `start_replay`.
+
+        :param device_under_test: fixture that provides a
+            :py:class:`tango.DeviceProxy` to the device under test, in a
+            :py:class:`tango.test_context.DeviceTestContext`.
+        :param mock_component_manager: a mock component manager that has
+            been patched into the device under test
+        """
+        device_under_test.adminMode = AdminMode.ONLINE
+
+        argin = {"replay_file": "/data/capture.pcap", "speed_factor": 2.0}
+        [result_code], [response] = device_under_test.StartReplay(json.dumps(argin))
+
+        assert result_code == ResultCode.QUEUED
+        assert "StartReplay" in response.split("_")[-1]
+
+        call_args = mock_component_manager.start_replay.call_args
+        assert call_args.args[0] == "/data/capture.pcap"
+        assert call_args.args[1] == 2.0
+
+    def test_profile_capture_device(
+        self: TestPatchedDaq,
+        device_under_test: tango.DeviceProxy,
+        mock_component_manager: unittest.mock.Mock,
+    ) -> None:
+        """
+        Test for ProfileCapture().
+
+        This tests that when we pass a valid json string to the
+        `ProfileCapture` command it is parsed into the proper parameters
+        for `profile_capture`.
+
+        :param device_under_test: fixture that provides a
+            :py:class:`tango.DeviceProxy` to the device under test, in a
+            :py:class:`tango.test_context.DeviceTestContext`.
+        :param mock_component_manager: a mock component manager that has
+            been patched into the device under test
+        """
+        device_under_test.adminMode = AdminMode.ONLINE
+
+        argin = {"duration": 30.0}
+        [result_code], [response] = device_under_test.ProfileCapture(
+            json.dumps(argin)
+        )
+
+        assert result_code == ResultCode.QUEUED
+        assert "ProfileCapture" in response.split("_")[-1]
+
+        call_args = mock_component_manager.profile_capture.call_args
+        assert call_args.args[0] == 30.0
+
+    def test_trigger_antenna_buffer_device(
+        self: TestPatchedDaq,
+        device_under_test: tango.DeviceProxy,
+        mock_component_manager: unittest.mock.Mock,
+    ) -> None:
+        """
+        Test for TriggerAntennaBuffer().
+
+        This tests that the `TriggerAntennaBuffer` command calls
+        `trigger_antenna_buffer` on the component manager and reports a
+        failure when the trigger cannot be issued.
+
+        :param device_under_test: fixture that provides a
+            :py:class:`tango.DeviceProxy` to the device under test, in a
+            :py:class:`tango.test_context.DeviceTestContext`.
+        :param mock_component_manager: a mock component manager that has
+            been patched into the device under test
+        """
+        device_under_test.adminMode = AdminMode.ONLINE
+
+        [result_code], [response] = device_under_test.TriggerAntennaBuffer()
+        assert result_code == ResultCode.OK
+        assert response == "TriggerAntennaBuffer command completed OK"
+        mock_component_manager.trigger_antenna_buffer.assert_called_once()
+
+        mock_component_manager.trigger_antenna_buffer.return_value = (
+            False,
+            "Antenna buffer trigger failed: consumer not running",
+        )
+        [result_code], [response] = device_under_test.TriggerAntennaBuffer()
+        assert result_code == ResultCode.FAILED
+        assert response == "Antenna buffer trigger failed: consumer not running"
+
+    def test_receiver_stats_attributes(
+        self: TestPatchedDaq,
+        device_under_test: tango.DeviceProxy,
+        mock_component_manager: unittest.mock.Mock,
+    ) -> None:
+        """
+        Test the receiver statistics attributes.
+
+        This tests that the statistics reported by the component manager
+        are surfaced through the device attributes, and that the scalar
+        attributes fall back to zero when the linked aavs_system does not
+        support statistics collection.
+
+        :param device_under_test: fixture that provides a
+            :py:class:`tango.DeviceProxy` to the device under test, in a
+            :py:class:`tango.test_context.DeviceTestContext`.
+        :param mock_component_manager: a mock component manager that has
+            been patched into the device under test
+        """
+        receiver_stats = {
+            "packets_received": 123456,
+            "packets_dropped": 42,
+            "buffers_processed": 512,
+            "buffers_overflowed": 3,
+        }
+        mock_component_manager.get_receiver_stats.return_value = receiver_stats
+
+        assert device_under_test.packetsReceived == 123456
+        assert device_under_test.packetsDropped == 42
+        assert device_under_test.buffersProcessed == 512
+        assert device_under_test.buffersOverflowed == 3
+        assert json.loads(device_under_test.receiverStats) == receiver_stats
+
+        # Statistics unsupported by the linked aavs_system version.
+        mock_component_manager.get_receiver_stats.return_value = {}
+        assert device_under_test.packetsReceived == 0
+        assert device_under_test.packetsDropped == 0
+        assert json.loads(device_under_test.receiverStats) == {}